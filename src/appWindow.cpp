@@ -2,84 +2,92 @@
  * implements appWindow.hpp header file
  */
 
+#include <ctime>
+#include <cstdio>
 #include "appWindow.hpp"
 
 
 /* === pathfinder app window class implementation ========================== */
-AppWindow::AppWindow(unsigned int width, unsigned int height) {
+AppWindow::AppWindow(unsigned int width, unsigned int height, bool record, const SearchConfig & searchConfig) {
     window.create(sf::VideoMode(width, height),"Pathfinder");
-    isPaused = false;
     this->loadNewMap();
+    simulation.setSearchConfig(searchConfig);
+    if (record) {
+        logPath = SESSION_LOG_PREFIX + std::to_string(std::time(nullptr)) + ".pflog";
+        simulation.setRecorder(&eventLog);
+    }
 }
 
 void AppWindow::launchWin() {
     // main loop
-    sf::Time elapsed;
+    sessionClock.restart();
     while (window.isOpen()) {
         // event loop (checks for triggered events in every iteration)
         while (window.pollEvent(event)) {
             if (event.type == sf::Event::Closed) window.close(); // window close
-            if (event.type == sf::Event::MouseButtonPressed) checkPixelClick(); detectShortestPath(); // runner selection
+            if (event.type == sf::Event::MouseButtonPressed) checkPixelClick(); // runner selection
             if (event.type == sf::Event::KeyPressed) { // keyboard presses
-                if (event.key.code == sf::Keyboard::W) map.updateRunnerPosition(UP); detectShortestPath();
-                if (event.key.code == sf::Keyboard::S) map.updateRunnerPosition(DOWN); detectShortestPath();
-                if (event.key.code == sf::Keyboard::D) map.updateRunnerPosition(RIGHT); detectShortestPath();
-                if (event.key.code == sf::Keyboard::A) map.updateRunnerPosition(LEFT); detectShortestPath();
-                if (event.key.code == sf::Keyboard::Enter) detectShortestPath(); // calculates path
+                unsigned int time = getSessionTime();
+                if (event.key.code == sf::Keyboard::W) simulation.apply(SimEvent::runnerMove(time, UP));
+                if (event.key.code == sf::Keyboard::S) simulation.apply(SimEvent::runnerMove(time, DOWN));
+                if (event.key.code == sf::Keyboard::D) simulation.apply(SimEvent::runnerMove(time, RIGHT));
+                if (event.key.code == sf::Keyboard::A) simulation.apply(SimEvent::runnerMove(time, LEFT));
+                if (event.key.code == sf::Keyboard::Enter) simulation.apply(SimEvent::findPath(time)); // calculates path
                 if (event.key.code == sf::Keyboard::RShift) loadNewMap(); // loads a new map
-                if (event.key.code == sf::Keyboard::Space) isPaused = !isPaused; // pauses/unpauses the game
+                if (event.key.code == sf::Keyboard::Space) simulation.apply(SimEvent::pause(time)); // pauses/unpauses the game
             }
         }
 
         // pixel update operations
         if (clock.getElapsedTime().asSeconds() > 0.5) {
-            elapsed = clock.getElapsedTime();
             clock.restart();
-            // make a tracker move every 1 second
-            if (!isPaused && !shortestPath.empty()) updateTrackerPos();
-
+            // make a tracker move every 0.5 seconds
+            simulation.apply(SimEvent::trackerTick(getSessionTime()));
+        }
+        // storing the session regularly, so that it is not lost if the app exits early
+        if (flushClock.getElapsedTime().asSeconds() > LOG_FLUSH_INTERVAL) {
+            flushClock.restart();
+            flushLog();
         }
         window.clear(sf::Color::Black);
-        window.draw(map);
+        window.draw(simulation.getMap());
         window.display();
     }
+    flushLog();
 }
 
 
 /* === pathfinder app window operation functions ========================== */
 void AppWindow::loadNewMap() {
-    map = Map(window.getSize().x/TILE_SIZE, window.getSize().y/TILE_SIZE);
+    Map map = Map(window.getSize().x/TILE_SIZE, window.getSize().y/TILE_SIZE);
     if (!map.load(TEXTURE_PATH)) {
         fprintf(stderr, "Map could not be loaded\n");
+        flushLog();
         exit(-1); // map could not be loaded
     }
+    simulation.loadMap(map, getSessionTime());
 }
 
-void AppWindow::detectShortestPath() {
-    shortestPath = getShortestPath(map);
-    // removing the first and last from tracker (so that tracker and runner are not shown as path)
-    shortestPath.pop_back(); shortestPath.erase(shortestPath.begin());
-    // display the shortestPath if a path has been found
-    if (!shortestPath.empty()) map.displayPath(shortestPath);
-}
-
-void AppWindow::updateTrackerPos() {
-    sf::Vector2u trackerPos = Pixel::getTracker(this->map.getPixels()).getPos();
-    sf::Vector2u pathPos = shortestPath.front().getPos();
-    sf::Vector2i directionI = sf::Vector2i {static_cast<int>(pathPos.x - trackerPos.x),
-                                            static_cast<int>(pathPos.y - trackerPos.y)};
-    shortestPath.erase(shortestPath.begin());
-    this->map.displayPath(shortestPath);
-    this->map.updateTrackerPosition(directionI);
-}
-
-
 void AppWindow::checkPixelClick() {
-    for (auto & pixelRow : map.getPixels()) {
+    for (auto & pixelRow : simulation.getMap().getPixels()) {
         for (auto & pixel : pixelRow) {
             if (pixel.clickedOn(event.mouseButton)) {
-                map.updatePixel(pixel.getPos().x, pixel.getPos().y);
+                simulation.apply(SimEvent::tileToggle(getSessionTime(), pixel.getPos()));
+                return;
             }
         }
     }
 }
+
+void AppWindow::flushLog() {
+    // writing into a temporary file first, so that an interrupted flush keeps the previous log intact
+    if (logPath.empty() || !eventLog.save(logPath + ".tmp")) return;
+    std::remove(logPath.c_str()); // rename does not replace existing files on every platform
+    if (std::rename((logPath + ".tmp").c_str(), logPath.c_str()) != 0) {
+        fprintf(stderr, "session log %s could not be replaced\n", logPath.c_str());
+    }
+}
+
+unsigned int AppWindow::getSessionTime() const {
+    return static_cast<unsigned int>(sessionClock.getElapsedTime().asMilliseconds());
+}
@@ -5,10 +5,13 @@
 #ifndef PATHFINDER_APP_WINDOW_HPP
 #define PATHFINDER_APP_WINDOW_HPP
 #define TEXTURE_PATH "assets/images/pathfinder_tileset2.png"
+#define SESSION_LOG_PREFIX "session_" // event logs of recorded sessions: session_<start time>.pflog
+#define LOG_FLUSH_INTERVAL 5 // seconds between writes of the session log
 
 #include <SFML/Graphics.hpp>
 #include "map.hpp"
-#include "pathfinder.hpp"
+#include "simulation.hpp"
+#include "eventLog.hpp"
 
 
 /* === pathfinder app window class definition ========================== */
@@ -16,20 +19,22 @@ class AppWindow {
     sf::RenderWindow window;
     sf::Event event{};
     sf::Clock clock;
-    Map map; // pathfinder map
-    std::vector<Pixel> shortestPath; // last updated path between tracker and runner
-    bool isPaused; // whether the tracker should be paused
+    sf::Clock sessionClock; // time since the window was launched
+    sf::Clock flushClock; // time since the session log was last written
+    Simulation simulation; // pathfinder map, tracker and runner
+    EventLog eventLog; // events of the session
+    std::string logPath; // session log file (empty if the session is not recorded)
 
 public:
     /* === constructors and destructor === */
-    explicit AppWindow (unsigned int, unsigned int);
+    explicit AppWindow (unsigned int, unsigned int, bool, const SearchConfig&); // window size, recording, movement model
     void launchWin ();
 
     /* === app window operation functions === */
     void loadNewMap ();
-    void detectShortestPath ();
-    void updateTrackerPos ();
     void checkPixelClick ();
+    void flushLog (); // writes the session log (if recorded)
+    unsigned int getSessionTime () const; // milliseconds since the window was launched
 };
 
 
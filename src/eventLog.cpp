@@ -0,0 +1,210 @@
+/**
+ * implementation of eventLog.hpp header file
+ *
+ * log file format: magic, format version, search config (4 bytes), then a record per event.
+ * search config: connectivity, corner rule, cost type, heuristic (1 byte each)
+ * record: event type (1 byte), time since the previous event (varint), payload
+ * - RUNNER_MOVE: direction (1 byte, (x+1)*3 + (y+1))
+ * - TILE_TOGGLE: pixel x, y (varints)
+ * - NEW_MAP: map width, height (varints), pixel types (4 bits each)
+ */
+
+#include <fstream>
+#include "eventLog.hpp"
+
+
+/* === event log helper functions ========================== */
+static void writeVarint(std::ostream & out, unsigned long value) {
+    // 7 bits per byte, highest bit set while more bytes follow
+    while (value >= 0x80) {
+        out.put(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    } out.put(static_cast<char>(value));
+}
+
+static bool readVarint(std::istream & in, unsigned long & value) {
+    value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+        int byte = in.get();
+        if (byte == EOF) return false;
+        value |= static_cast<unsigned long>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    } return false;
+}
+
+
+/* === simulation event constructors ========================== */
+SimEvent SimEvent::runnerMove(unsigned int time, sf::Vector2i direction) {
+    return SimEvent{RUNNER_MOVE, time, direction, sf::Vector2u{}, 0};
+}
+SimEvent SimEvent::tileToggle(unsigned int time, sf::Vector2u pos) {
+    return SimEvent{TILE_TOGGLE, time, sf::Vector2i{}, pos, 0};
+}
+SimEvent SimEvent::trackerTick(unsigned int time) {
+    return SimEvent{TRACKER_TICK, time, sf::Vector2i{}, sf::Vector2u{}, 0};
+}
+SimEvent SimEvent::findPath(unsigned int time) {
+    return SimEvent{FIND_PATH, time, sf::Vector2i{}, sf::Vector2u{}, 0};
+}
+SimEvent SimEvent::pause(unsigned int time) {
+    return SimEvent{PAUSE, time, sf::Vector2i{}, sf::Vector2u{}, 0};
+}
+SimEvent SimEvent::newMap(unsigned int time, unsigned int mapIndex) {
+    return SimEvent{NEW_MAP, time, sf::Vector2i{}, sf::Vector2u{}, mapIndex};
+}
+
+
+/* === event log operation functions ========================== */
+void EventLog::addEvent(const SimEvent & event) {
+    m_events.push_back(event);
+}
+
+unsigned int EventLog::addMap(Map & map) {
+    MapSnapshot snapshot{map.getSize(), {}};
+    for (auto & pixelRow : map.getPixels()) {
+        for (auto & pixel : pixelRow) {
+            snapshot.types.push_back(pixel.getType());
+        }
+    }
+    m_maps.push_back(snapshot);
+    return static_cast<unsigned int>(m_maps.size() - 1);
+}
+
+bool EventLog::save(const std::string & path) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        fprintf(stderr, "event log %s could not be opened for writing\n", path.c_str());
+        return false;
+    }
+    out.write(LOG_MAGIC, 4);
+    out.put(LOG_FORMAT_VERSION);
+    out.put(static_cast<char>(searchConfig.connectivity));
+    out.put(static_cast<char>(searchConfig.cornerRule));
+    out.put(static_cast<char>(searchConfig.costType));
+    out.put(static_cast<char>(searchConfig.heuristic));
+
+    unsigned int prevTime = 0;
+    for (auto & event : m_events) {
+        out.put(static_cast<char>(event.type));
+        writeVarint(out, event.time - prevTime);
+        prevTime = event.time;
+
+        if (event.type == SimEvent::RUNNER_MOVE) {
+            out.put(static_cast<char>((event.direction.x + 1) * 3 + (event.direction.y + 1)));
+        }
+        else if (event.type == SimEvent::TILE_TOGGLE) {
+            writeVarint(out, event.pos.x);
+            writeVarint(out, event.pos.y);
+        }
+        else if (event.type == SimEvent::NEW_MAP) {
+            const MapSnapshot & snapshot = m_maps[event.mapIndex];
+            writeVarint(out, snapshot.size.x);
+            writeVarint(out, snapshot.size.y);
+            // two pixel types per byte
+            for (unsigned int i = 0; i < snapshot.types.size(); i += 2) {
+                int high = i + 1 < snapshot.types.size() ? snapshot.types[i + 1] : 0;
+                out.put(static_cast<char>(snapshot.types[i] | (high << 4)));
+            }
+        }
+    }
+    if (!out) {
+        fprintf(stderr, "event log %s could not be written\n", path.c_str());
+        return false;
+    } return true;
+}
+
+bool EventLog::load(const std::string & path) {
+    clear();
+    std::ifstream in(path, std::ios::binary);
+    char magic[4] = {};
+    if (!in.read(magic, 4) || std::string(magic, 4) != LOG_MAGIC || in.get() != LOG_FORMAT_VERSION) {
+        fprintf(stderr, "%s is not a (supported) event log\n", path.c_str());
+        return false;
+    }
+    int connectivity = in.get(), cornerRule = in.get(), costType = in.get(), heuristic = in.get();
+    if (heuristic == EOF) return loadError(path, "truncated search config");
+    if ((connectivity != SearchConfig::FOUR_CONNECTED && connectivity != SearchConfig::EIGHT_CONNECTED)
+        || cornerRule > SearchConfig::NO_CORNER_CUTTING || costType > SearchConfig::FLOAT_COST
+        || heuristic > SearchConfig::DIJKSTRA) return loadError(path, "invalid search config");
+    searchConfig.connectivity = static_cast<SearchConfig::Connectivity>(connectivity);
+    searchConfig.cornerRule = static_cast<SearchConfig::CornerRule>(cornerRule);
+    searchConfig.costType = static_cast<SearchConfig::CostType>(costType);
+    searchConfig.heuristic = static_cast<SearchConfig::Heuristic>(heuristic);
+    if (!searchConfig.isAdmissible()) return loadError(path, "search config does not find shortest paths");
+
+    unsigned long time = 0, timeDelta, x, y;
+    sf::Vector2u mapSize; // size of the last loaded map (events are validated against it)
+    for (int type = in.get(); type != EOF; type = in.get()) {
+        if (!readVarint(in, timeDelta)) return loadError(path, "truncated event");
+        time += timeDelta;
+        auto eventTime = static_cast<unsigned int>(time);
+        if (m_maps.empty() && type != SimEvent::NEW_MAP) return loadError(path, "event before the first map");
+
+        if (type == SimEvent::RUNNER_MOVE) {
+            int direction = in.get();
+            if (direction == EOF) return loadError(path, "truncated event");
+            if (direction > 8) return loadError(path, "invalid runner direction");
+            addEvent(SimEvent::runnerMove(eventTime, sf::Vector2i{direction / 3 - 1, direction % 3 - 1}));
+        }
+        else if (type == SimEvent::TILE_TOGGLE) {
+            if (!readVarint(in, x) || !readVarint(in, y)) return loadError(path, "truncated event");
+            if (x >= mapSize.x || y >= mapSize.y) return loadError(path, "toggled pixel outside of the map");
+            addEvent(SimEvent::tileToggle(eventTime, sf::Vector2u{static_cast<unsigned int>(x),
+                                                                    static_cast<unsigned int>(y)}));
+        }
+        else if (type == SimEvent::TRACKER_TICK) addEvent(SimEvent::trackerTick(eventTime));
+        else if (type == SimEvent::FIND_PATH) addEvent(SimEvent::findPath(eventTime));
+        else if (type == SimEvent::PAUSE) addEvent(SimEvent::pause(eventTime));
+        else if (type == SimEvent::NEW_MAP) {
+            if (!readVarint(in, x) || !readVarint(in, y)) return loadError(path, "truncated map");
+            if (x > LOG_MAX_MAP_SIZE || y > LOG_MAX_MAP_SIZE) return loadError(path, "map is too large");
+            mapSize = sf::Vector2u{static_cast<unsigned int>(x), static_cast<unsigned int>(y)};
+            MapSnapshot snapshot{mapSize, {}};
+            std::string packed((x * y + 1) / 2, '\0');
+            if (!in.read(&packed[0], static_cast<std::streamsize>(packed.size()))) return loadError(path, "truncated map");
+
+            int trackers = 0, runners = 0;
+            for (unsigned long i = 0; i < x * y; i++) {
+                int pixelType = (static_cast<unsigned char>(packed[i / 2]) >> (i % 2 * 4)) & 0x0F;
+                if (pixelType > Pixel::PATH) return loadError(path, "invalid pixel type");
+                trackers += pixelType == Pixel::TRACKER;
+                runners += pixelType == Pixel::RUNNER;
+                snapshot.types.push_back(static_cast<Pixel::Type>(pixelType));
+            }
+            if (trackers != 1 || runners != 1) return loadError(path, "map needs exactly one tracker and runner");
+            m_maps.push_back(snapshot);
+            addEvent(SimEvent::newMap(eventTime, static_cast<unsigned int>(m_maps.size() - 1)));
+        }
+        else return loadError(path, "invalid event type");
+    }
+    return true;
+}
+
+bool EventLog::loadError(const std::string & path, const std::string & reason) {
+    fprintf(stderr, "event log %s could not be loaded: %s\n", path.c_str(), reason.c_str());
+    clear(); // partially loaded logs are not kept
+    return false;
+}
+
+void EventLog::clear() {
+    m_events.clear();
+    m_maps.clear();
+    searchConfig = SearchConfig();
+}
+
+
+/* === event log getters and setters ========================== */
+const std::vector<SimEvent> &EventLog::getEvents() const {
+    return m_events;
+}
+Map EventLog::getMap(unsigned int mapIndex) const {
+    const MapSnapshot & snapshot = m_maps[mapIndex];
+    return Map(snapshot.size, snapshot.types);
+}
+const SearchConfig &EventLog::getSearchConfig() const {
+    return searchConfig;
+}
+
+void EventLog::setSearchConfig(const SearchConfig & config) {
+    searchConfig = config;
+}
@@ -0,0 +1,73 @@
+/**
+ * represents the simulation events and their compact binary log.
+ * a log stores the maps and events of a session, so that it can be replayed exactly.
+ */
+
+#ifndef PATHFINDER_EVENT_LOG_HPP
+#define PATHFINDER_EVENT_LOG_HPP
+#define LOG_MAGIC "PFLG" // first bytes of a log file
+#define LOG_FORMAT_VERSION 2 // version of the log file format
+#define LOG_MAX_MAP_SIZE 1024 // max width and height of a logged map
+
+#include <string>
+#include "map.hpp"
+#include "pathfinder.hpp"
+
+
+/* === simulation event structure definition ========================== */
+struct SimEvent {
+    enum Type { // with flags
+        RUNNER_MOVE=0, // runner moves in a direction
+        TILE_TOGGLE=1, // pixel is toggled (as if clicked on)
+        TRACKER_TICK=2, // tracker makes a move along its path (unless paused)
+        FIND_PATH=3, // path between tracker and runner is recalculated
+        PAUSE=4, // tracker is paused/unpaused
+        NEW_MAP=5 // a new map is loaded (map is stored in the log)
+    };
+    Type type;
+    unsigned int time; // milliseconds since the start of the session
+    sf::Vector2i direction; // RUNNER_MOVE direction
+    sf::Vector2u pos; // TILE_TOGGLE pixel position
+    unsigned int mapIndex; // NEW_MAP index of the map in the log
+
+    /* === event constructors === */
+    static SimEvent runnerMove (unsigned int, sf::Vector2i);
+    static SimEvent tileToggle (unsigned int, sf::Vector2u);
+    static SimEvent trackerTick (unsigned int);
+    static SimEvent findPath (unsigned int);
+    static SimEvent pause (unsigned int);
+    static SimEvent newMap (unsigned int, unsigned int);
+};
+
+struct MapSnapshot {
+    sf::Vector2u size;
+    std::vector<Pixel::Type> types; // pixel types, column by column (as in Map's pixels)
+};
+
+
+/* === event log class definition ========================== */
+class EventLog {
+    std::vector<SimEvent> m_events; // events in order of occurrence
+    std::vector<MapSnapshot> m_maps; // maps loaded by NEW_MAP events
+    SearchConfig searchConfig; // search configuration of the session
+
+    bool loadError (const std::string&, const std::string&); // reports an invalid log (and drops its contents)
+
+public:
+    /* === event log operation functions === */
+    void addEvent (const SimEvent&);
+    unsigned int addMap (Map&); // stores the pixels of a map, returns its index
+    bool save (const std::string&) const; // writes the log into a binary file
+    bool load (const std::string&); // reads the log from a binary file
+    void clear ();
+
+    /* === getters and setters === */
+    const std::vector<SimEvent> & getEvents () const;
+    Map getMap (unsigned int) const; // headless (not textured) copy of a stored map
+    const SearchConfig & getSearchConfig () const;
+
+    void setSearchConfig (const SearchConfig&);
+};
+
+
+#endif
@@ -0,0 +1,123 @@
+/**
+ * event log checks: a recorded session survives a save/load round trip
+ * and replays exactly, and invalid logs are rejected.
+ */
+
+#include <fstream>
+#include "simulation.hpp"
+#define TEST_LOG_PATH "eventLogTest.pflog"
+
+static int failures = 0;
+static void check(bool condition, const char * description) {
+    if (!condition) {
+        fprintf(stderr, "FAILED: %s\n", description);
+        failures++;
+    }
+}
+
+static std::vector<Pixel::Type> getTypes(Map & map) {
+    std::vector<Pixel::Type> types;
+    for (auto & pixelRow : map.getPixels()) {
+        for (auto & pixel : pixelRow) types.push_back(pixel.getType());
+    } return types;
+}
+
+static std::vector<sf::Vector2u> getPositions(std::vector<Pixel> & path) {
+    std::vector<sf::Vector2u> positions;
+    for (auto & pixel : path) positions.push_back(pixel.getPos());
+    return positions;
+}
+
+static bool loadBytes(const std::string & bytes, const std::string & config = std::string("\x08\x01\x00\x00", 4)) {
+    // writes given bytes (after the log header and search config) and loads them as a log
+    std::ofstream(TEST_LOG_PATH, std::ios::binary) << LOG_MAGIC << static_cast<char>(LOG_FORMAT_VERSION)
+                                                   << config << bytes;
+    EventLog log;
+    return log.load(TEST_LOG_PATH);
+}
+
+
+/* === event log checks ========================== */
+static void checkRoundTrip() {
+    // 6x5 map with a wall between the tracker and the runner
+    std::vector<Pixel::Type> types(6 * 5, Pixel::OPEN);
+    for (unsigned int y = 0; y < 4; y++) types[3 * 5 + y] = Pixel::CLOSED;
+    Simulation simulation(Map(sf::Vector2u{6, 5}, types), sf::Vector2u{0, 0}, sf::Vector2u{5, 0});
+    SearchConfig config;
+    SearchConfig::parse("4,cut,float,euclidean", config);
+    simulation.setSearchConfig(config);
+    EventLog log;
+    simulation.setRecorder(&log);
+
+    unsigned int time = 0;
+    simulation.apply(SimEvent::findPath(time += 10));
+    for (int i = 0; i < 3; i++) simulation.apply(SimEvent::trackerTick(time += 500));
+    simulation.apply(SimEvent::runnerMove(time += 200, DOWN));
+    simulation.apply(SimEvent::tileToggle(time += 300, sf::Vector2u{3, 4})); // closing the only gap
+    simulation.apply(SimEvent::tileToggle(time += 300, sf::Vector2u{3, 0})); // opening a new gap
+    simulation.apply(SimEvent::pause(time += 100));
+    simulation.apply(SimEvent::trackerTick(time += 500));
+    simulation.apply(SimEvent::pause(time += 100));
+    for (int i = 0; i < 4; i++) simulation.apply(SimEvent::trackerTick(time += 500));
+    simulation.loadMap(Map(sf::Vector2u{6, 5}, getTypes(simulation.getMap())), time += 70000); // large time delta
+    std::vector<Pixel::Type> lastMapTypes = getTypes(simulation.getMap());
+    for (int i = 0; i < 3; i++) simulation.apply(SimEvent::runnerMove(time += 200, DOWN)); // away from the tracker
+
+    check(log.save(TEST_LOG_PATH), "log is saved");
+    EventLog loaded;
+    check(loaded.load(TEST_LOG_PATH), "saved log is loaded");
+    check(loaded.getEvents().size() == log.getEvents().size(), "loaded log has all events");
+    check(loaded.getSearchConfig() == config, "loaded log has the recorded search config");
+    for (unsigned int i = 0; i < loaded.getEvents().size() && i < log.getEvents().size(); i++) {
+        const SimEvent & event1 = log.getEvents()[i], & event2 = loaded.getEvents()[i];
+        check(event1.type == event2.type && event1.time == event2.time && event1.direction == event2.direction
+              && event1.pos == event2.pos, "loaded event equals the recorded event");
+    }
+
+    // replaying reproduces the session (and records the same log)
+    Simulation replay;
+    EventLog replayLog;
+    replay.setRecorder(&replayLog);
+    replay.replay(loaded);
+    unsigned int lastMapIndex = 0;
+    for (auto & event : loaded.getEvents()) {
+        if (event.type == SimEvent::NEW_MAP) lastMapIndex = event.mapIndex;
+    }
+    Map loadedMap = loaded.getMap(lastMapIndex);
+    check(getTypes(replay.getMap()) == getTypes(simulation.getMap()), "replay ends on the recorded map");
+    check(getTypes(loadedMap) == lastMapTypes, "stored map equals the recorded map");
+    check(!simulation.getShortestPath().empty(), "session ends with a path");
+    check(getPositions(replay.getShortestPath()) == getPositions(simulation.getShortestPath()),
+          "replay ends on the recorded path");
+    check(replay.getSearchConfig() == config, "replay uses the recorded search config");
+    check(replayLog.getEvents().size() == log.getEvents().size(), "replay records the same events");
+}
+
+static void checkInvalidLogs() {
+    // 2x1 map with a tracker and a runner: type (NEW_MAP), time, width, height, packed pixels
+    const std::string validMap = std::string("\x05\x00\x02\x01", 4) + static_cast<char>(Pixel::TRACKER | Pixel::RUNNER << 4);
+    check(loadBytes(validMap), "valid map is loaded");
+    check(loadBytes(validMap + std::string("\x01\x00\x01\x00", 4)), "toggle on the map is loaded");
+    check(!loadBytes(validMap + std::string("\x01\x00\x32\x32", 4)), "toggle outside of the map is rejected");
+    check(!loadBytes(validMap + std::string("\x00\x00\x09", 3)), "invalid runner direction is rejected");
+    check(!loadBytes(std::string("\x02\x00", 2) + validMap), "event before the first map is rejected");
+    check(!loadBytes(std::string("\x05\x00\x02\x01", 4) + static_cast<char>(Pixel::TRACKER)),
+          "map without a runner is rejected");
+    check(!loadBytes(std::string("\x05\x00\xFF\xFF\x03\xFF\xFF\x03", 8)), "oversized map is rejected");
+    check(!loadBytes(validMap + std::string("\x01\x00\x01", 3)), "truncated event is rejected");
+    check(!loadBytes(validMap + std::string("\x07\x00", 2)), "invalid event type is rejected");
+    check(!loadBytes(validMap, std::string("\x06\x01\x00\x00", 4)), "invalid connectivity is rejected");
+    check(!loadBytes(validMap, std::string("\x08\x01\x00\x01", 4)), "8-connected manhattan search is rejected");
+    check(loadBytes(validMap, std::string("\x04\x00\x01\x01", 4)), "4-connected manhattan search is loaded");
+}
+
+
+/* === main function ========================== */
+int main() {
+    checkRoundTrip();
+    checkInvalidLogs();
+    std::remove(TEST_LOG_PATH);
+    if (failures) fprintf(stderr, "%d event log check(s) failed\n", failures);
+    else printf("event log checks passed\n");
+    return failures ? 1 : 0;
+}
@@ -5,8 +5,22 @@
 #include "appWindow.hpp"
 
 /* === main function ========================== */
-int main() {
-    AppWindow appWindow(500, 500);
+int main(int argc, char * argv[]) {
+    // --record: stores the session into an event log (see replay.cpp)
+    // --search <config>: movement model of the tracker (see SearchConfig::parse)
+    bool record = false;
+    SearchConfig searchConfig;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--record") record = true;
+        else if (arg == "--search" && i + 1 < argc && SearchConfig::parse(argv[i + 1], searchConfig)) i++;
+        else {
+            fprintf(stderr, "usage: %s [--record] [--search <4|8>,<cut|cut-unless-both|no-cut>,<int|float>,"
+                            "<octile|manhattan|euclidean|dijkstra>]\n", argv[0]);
+            return 1;
+        }
+    }
+    AppWindow appWindow(500, 500, record, searchConfig);
     appWindow.launchWin();
     return 0;
 }
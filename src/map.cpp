@@ -11,6 +11,18 @@ Map::Map(unsigned int width, unsigned int height) {
     this->size = sf::Vector2u{width, height};
     randMap(); // sets up a random map
 }
+Map::Map(sf::Vector2u size, const std::vector<Pixel::Type> & types) {
+    this->size = size;
+    m_pixels = std::vector<std::vector<Pixel>>(size.x); // allocation
+    m_editVersions = std::vector<std::vector<unsigned long>>(size.x, std::vector<unsigned long>(size.y, 0));
+    for (unsigned int x = 0; x < size.x; x++) {
+        m_pixels[x] = std::vector<Pixel>(size.y);
+        for (unsigned int y = 0; y < size.y; y++) {
+            m_pixels[x][y] = Pixel(types[x * size.y + y]);
+            m_pixels[x][y].setPos(x, y);
+        }
+    }
+}
 
 void Map::draw(sf::RenderTarget & target, sf::RenderStates states) const {
     states.transform *= getTransform();
@@ -44,6 +56,7 @@ bool Map::load(const std::string & tileSet) {
 
 void Map::randMap() {
     m_pixels = std::vector<std::vector<Pixel>>(size.x); // allocation
+    m_editVersions = std::vector<std::vector<unsigned long>>(size.x, std::vector<unsigned long>(size.y, 0));
     for (unsigned int x = 0; x < size.x; x++) {
         m_pixels[x] = std::vector<Pixel>(size.y);
         for (unsigned int y = 0; y < size.y; y++) {
@@ -76,11 +89,11 @@ void Map::updatePixel(unsigned int x, unsigned int y) {
     }
     else if (pixel.getType() == Pixel::OPEN || pixel.getType() == Pixel::PATH) {
         pixel.setType(Pixel::CLOSED);
-        updateTexture(pixel);
+        updateTexture(pixel); markEdited(pixel);
     }
     else if (pixel.getType() == Pixel::CLOSED) {
         pixel.setType(Pixel::OPEN);
-        updateTexture(pixel);
+        updateTexture(pixel); markEdited(pixel);
     }
 }
 
@@ -101,6 +114,7 @@ void Map::displayPath(std::vector<Pixel> & pixelPath) {
 }
 
 void Map::updatePosition(Pixel & pixel) { // upon reloading
+    if (m_vertices.getVertexCount() == 0) return; // headless map (tile set not loaded)
     // selecting the quad to be updated
     sf::Vertex * quad = &m_vertices[(pixel.getPos().x + pixel.getPos().y * size.x) * 4];
     auto fI = static_cast<float>(pixel.getPos().x); auto fJ = static_cast<float>(pixel.getPos().y);
@@ -125,6 +139,7 @@ void Map::updatePosition(Pixel & pixel, sf::Vector2i direction) { // updates tra
     if (!targetPixel.isTraversable(this->size)) return;
 
     // swapping and updating the 2 pixels
+    // (both pixels stay traversable, so the swap is not recorded as an edit)
     Pixel temp = pixel;
     pixel.setType(targetPixel.getType());
     targetPixel.setType(temp.getType());
@@ -145,6 +160,7 @@ void Map::updateRunnerPosition(sf::Vector2i direction) {
 }
 
 void Map::updateTexture(Pixel & pixel) {
+    if (m_vertices.getVertexCount() == 0) return; // headless map (tile set not loaded)
     // selecting the quad to be updated
     sf::Vertex * quad = &m_vertices[(pixel.getPos().x + pixel.getPos().y * size.x) * 4];
     // setting texture start and end locations
@@ -162,6 +178,13 @@ void Map::updateTexture(Pixel & pixel) {
     quad[3].texCoords = sf::Vector2f(textureStart, static_cast<float>(m_tilesSet.getSize().y));
 }
 
+void Map::markEdited(Pixel & pixel) {
+    // TRACKER<==>RUNNER swaps and path display keep pixels traversable, only OPEN<===>CLOSED counts as an edit
+    version++;
+    m_editVersions[pixel.getPos().x][pixel.getPos().y] = version;
+    if (pixel.isTraversable(this->size)) openedVersion = version; // an opened pixel may shorten any path
+}
+
 
 /* === pathfinder map class getters and setters ========================== */
 std::vector<Pixel *> Map::getOpenPixels() {
@@ -178,6 +201,15 @@ std::vector<std::vector<Pixel>> &Map::getPixels() {
 sf::Vector2u Map::getSize() const {
     return size;
 }
+unsigned long Map::getVersion() const {
+    return version;
+}
+unsigned long Map::getOpenedVersion() const {
+    return openedVersion;
+}
+unsigned long Map::getEditVersion(sf::Vector2u pos) const {
+    return m_editVersions[pos.x][pos.y];
+}
 
 void Map::setSize(sf::Vector2u & newSize) {
     this->size = newSize;
@@ -190,5 +222,20 @@ void Map::setRandPlayers() {
     openPixels[index1]->setType(Pixel::TRACKER);
     openPixels[index2]->setType(Pixel::RUNNER);
 }
+void Map::setPlayers(sf::Vector2u trackerPos, sf::Vector2u runnerPos) {
+    // existing players are replaced with open pixels
+    for (auto & pixelRow : m_pixels) {
+        for (auto & pixel : pixelRow) {
+            if (pixel.getType() == Pixel::TRACKER || pixel.getType() == Pixel::RUNNER) {
+                pixel.setType(Pixel::OPEN); updateTexture(pixel);
+            }
+        }
+    }
+    // players may be placed on obstacles, hence both placements are recorded as edits
+    Pixel & tracker = m_pixels[trackerPos.x][trackerPos.y];
+    tracker.setType(Pixel::TRACKER); updateTexture(tracker); markEdited(tracker);
+    Pixel & runner = m_pixels[runnerPos.x][runnerPos.y];
+    runner.setType(Pixel::RUNNER); updateTexture(runner); markEdited(runner);
+}
 
 Map::~Map() = default;
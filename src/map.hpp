@@ -15,6 +15,9 @@ class Map: public sf::Drawable, public sf::Transformable {
     std::vector<std::vector<Pixel>> m_pixels; // structural contents of the map
     sf::VertexArray m_vertices; // vertex set
     sf::Texture m_tilesSet; // texture set
+    unsigned long version = 0; // incremented on every traversability edit
+    unsigned long openedVersion = 0; // version of the last edit that opened a pixel
+    std::vector<std::vector<unsigned long>> m_editVersions; // version of the last edit per pixel
 
     void draw (sf::RenderTarget&, sf::RenderStates) const override;
 
@@ -22,6 +25,7 @@ public:
     /* === constructors and destructor === */
     Map ();
     explicit Map (unsigned int, unsigned int);
+    explicit Map (sf::Vector2u, const std::vector<Pixel::Type>&); // map of given pixel types (column by column)
     ~Map () override;
 
     /* === map operation functions === */
@@ -35,14 +39,19 @@ public:
     void updateRunnerPosition (sf::Vector2i); // update position of runner pixel (based on movement directions)
     void updateTrackerPosition (sf::Vector2i); // update position of tracker pixel
     void updateTexture (Pixel&); // updates texture of a pixel (based on its type)
+    void markEdited (Pixel&); // records a traversability edit of a pixel
 
     /* === getters and setters === */
     std::vector<Pixel *> getOpenPixels (); // getting a list of open pixel areas
     std::vector<std::vector<Pixel>> & getPixels ();
     sf::Vector2u getSize () const;
+    unsigned long getVersion () const;
+    unsigned long getOpenedVersion () const;
+    unsigned long getEditVersion (sf::Vector2u) const; // version of the last edit of pixel at given position
 
     void setSize (sf::Vector2u&);
     void setRandPlayers (); // for now supports setting a runner and tracker
+    void setPlayers (sf::Vector2u, sf::Vector2u); // places the tracker and runner at given positions
 };
 
 
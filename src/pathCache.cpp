@@ -0,0 +1,94 @@
+/**
+ * implementation of pathCache.hpp header file
+ */
+
+#include <algorithm>
+#include "pathCache.hpp"
+
+
+/* === path cache operation functions ========================== */
+std::vector<Pixel> PathCache::getShortestPath(Map & map) {
+    Pixel tracker = Pixel::getTracker(map.getPixels());
+    Pixel runner = Pixel::getRunner(map.getPixels());
+    return getShortestPath(map, tracker, runner);
+}
+
+std::vector<Pixel> PathCache::getShortestPath(Map & map, Pixel & origin, Pixel & target) {
+    // paths of a non-admissible search are not shortest paths, hence validation does not apply to them
+    if (!searchConfig.isAdmissible()) {
+        misses++;
+        return ::getShortestPath(map, origin, target, searchConfig);
+    }
+
+    // an opened pixel invalidates every cached path
+    if (map.getOpenedVersion() > clearedVersion) {
+        clear();
+        clearedVersion = map.getOpenedVersion();
+    }
+
+    PATH_KEY key = std::make_tuple(origin.getPos().x, origin.getPos().y, target.getPos().x, target.getPos().y);
+    auto entry = m_entries.find(key);
+    if (entry != m_entries.end()) {
+        entry->second.lastUse = hits + misses;
+        if (isValid(map, entry->second)) {
+            hits++;
+            return entry->second.path;
+        }
+    }
+    else {
+        // dropping the least recently used path if the cache is full
+        if (m_entries.size() >= PATH_CACHE_CAPACITY) {
+            m_entries.erase(std::min_element(m_entries.begin(), m_entries.end(),
+                [](const std::pair<const PATH_KEY, PathEntry> & entry1, const std::pair<const PATH_KEY, PathEntry> & entry2) {
+                    return entry1.second.lastUse < entry2.second.lastUse;
+                }));
+        }
+        entry = m_entries.emplace(key, PathEntry{{}, 0, hits + misses}).first;
+    }
+
+    // no valid cached path: searching and (re)storing the result
+    misses++;
+    entry->second.path = ::getShortestPath(map, origin, target, searchConfig);
+    entry->second.version = map.getVersion();
+    return entry->second.path;
+}
+
+bool PathCache::isValid(Map & map, PathEntry & entry) {
+    // no edits since the path was found
+    if (entry.version == map.getVersion()) return true;
+    // an opened pixel may provide a shorter path (or a path where there was none)
+    if (entry.version < map.getOpenedVersion()) return false;
+
+    // only closed pixels since: path is valid unless it crosses (or cuts the corner of) an edited pixel
+    std::vector<Pixel> & path = entry.path;
+    for (unsigned int i = 0; i < path.size(); i++) {
+        if (map.getEditVersion(path[i].getPos()) > entry.version) return false;
+        if (i == 0 || !areDiagonal(path[i - 1], path[i])) continue;
+        sf::Vector2u corner1 = sf::Vector2u{path[i - 1].getPos().x, path[i].getPos().y};
+        sf::Vector2u corner2 = sf::Vector2u{path[i].getPos().x, path[i - 1].getPos().y};
+        if (map.getEditVersion(corner1) > entry.version || map.getEditVersion(corner2) > entry.version) return false;
+    } return true;
+}
+
+void PathCache::clear() {
+    m_entries.clear();
+    clearedVersion = 0;
+}
+
+
+/* === path cache getters and setters ========================== */
+unsigned long PathCache::getHits() const {
+    return hits;
+}
+unsigned long PathCache::getMisses() const {
+    return misses;
+}
+const SearchConfig &PathCache::getSearchConfig() const {
+    return searchConfig;
+}
+
+void PathCache::setSearchConfig(const SearchConfig & config) {
+    if (config == searchConfig) return;
+    searchConfig = config;
+    clear();
+}
@@ -0,0 +1,50 @@
+/**
+ * caches shortest paths between two points (pixels) of a map.
+ * cached paths are invalidated only by map edits that can change them.
+ */
+
+#ifndef PATHFINDER_PATH_CACHE_HPP
+#define PATHFINDER_PATH_CACHE_HPP
+#define PATH_CACHE_CAPACITY 1024 // max cached paths (least recently used are dropped first)
+
+#include <map>
+#include <tuple>
+#include "map.hpp"
+#include "pathfinder.hpp"
+
+
+/* === path cache structure definition ========================== */
+typedef std::tuple<unsigned int, unsigned int, unsigned int, unsigned int> PATH_KEY; // origin x, y and target x, y
+struct PathEntry {
+    std::vector<Pixel> path; // cached shortest path (empty if none was found)
+    unsigned long version; // map version the path was found at
+    unsigned long lastUse; // query count at the last use of the path (for evictions)
+};
+
+
+/* === path cache class definition ========================== */
+class PathCache {
+    std::map<PATH_KEY, PathEntry> m_entries; // cached paths
+    unsigned long clearedVersion = 0; // opened version of the map at the last clear
+    unsigned long hits = 0; // queries answered without a search
+    unsigned long misses = 0; // queries that required a search
+    SearchConfig searchConfig; // configuration of the searches
+
+    static bool isValid (Map&, PathEntry&); // whether a cached path is still the shortest path
+
+public:
+    /* === path cache operation functions === */
+    std::vector<Pixel> getShortestPath (Map&); // cached version of pathfinder's getShortestPath
+    std::vector<Pixel> getShortestPath (Map&, Pixel&, Pixel&);
+    void clear (); // drops all cached paths (e.g. when a new map is loaded)
+
+    /* === getters and setters === */
+    unsigned long getHits () const;
+    unsigned long getMisses () const;
+    const SearchConfig & getSearchConfig () const;
+
+    void setSearchConfig (const SearchConfig&); // drops cached paths if the configuration changes
+};
+
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * path cache checks: cached paths equal fresh searches after map edits,
+ * and only edits that can change a path invalidate it.
+ */
+
+#include "pathCache.hpp"
+
+static int failures = 0;
+static void check(bool condition, const char * description) {
+    if (!condition) {
+        fprintf(stderr, "FAILED: %s\n", description);
+        failures++;
+    }
+}
+
+static bool samePath(std::vector<Pixel> & path1, std::vector<Pixel> & path2) {
+    if (path1.size() != path2.size()) return false;
+    for (unsigned int i = 0; i < path1.size(); i++) {
+        if (path1[i].getPos() != path2[i].getPos()) return false;
+    } return true;
+}
+
+static void query(PathCache & cache, Map & map, bool expectHit, const char * description) {
+    // a cached query must answer as a fresh search would (and hit the cache only when expected)
+    unsigned long hits = cache.getHits(), misses = cache.getMisses();
+    std::vector<Pixel> cached = cache.getShortestPath(map);
+    Pixel tracker = Pixel::getTracker(map.getPixels());
+    Pixel runner = Pixel::getRunner(map.getPixels());
+    std::vector<Pixel> fresh = getShortestPath(map, tracker, runner, cache.getSearchConfig());
+    check(samePath(cached, fresh), description);
+    check(expectHit ? cache.getHits() == hits + 1 && cache.getMisses() == misses
+                    : cache.getHits() == hits && cache.getMisses() == misses + 1, description);
+}
+
+
+/* === path cache checks ========================== */
+static void checkStraightPath() {
+    // 7x5 open map, shortest path along y = 2
+    Map map(sf::Vector2u{7, 5}, std::vector<Pixel::Type>(7 * 5, Pixel::OPEN));
+    map.setPlayers(sf::Vector2u{0, 2}, sf::Vector2u{6, 2});
+    PathCache cache;
+    query(cache, map, false, "first query searches");
+    query(cache, map, true, "repeated query is cached");
+    map.updatePixel(3, 4);
+    query(cache, map, true, "closing a pixel off the path keeps the cached path");
+    map.updatePixel(3, 2);
+    query(cache, map, false, "closing a pixel on the path invalidates it");
+    query(cache, map, true, "path around the closed pixel is cached");
+    map.updatePixel(3, 4);
+    query(cache, map, false, "opening a pixel invalidates every path");
+}
+
+static void checkDiagonalPath(const char * configText, bool blockedByOneCorner) {
+    // 3x3 open map, shortest path along the diagonal
+    SearchConfig config;
+    SearchConfig::parse(configText, config);
+    Map map(sf::Vector2u{3, 3}, std::vector<Pixel::Type>(3 * 3, Pixel::OPEN));
+    map.setPlayers(sf::Vector2u{0, 0}, sf::Vector2u{2, 2});
+    PathCache cache;
+    cache.setSearchConfig(config);
+    query(cache, map, false, "first diagonal query searches");
+    check(cache.getShortestPath(map).size() == 3, "open diagonal is taken");
+    map.updatePixel(1, 0);
+    query(cache, map, false, "closing a corner of a cached diagonal move invalidates it");
+    check((cache.getShortestPath(map).size() == 3) != blockedByOneCorner, "diagonal past one closed corner");
+    map.updatePixel(0, 1);
+    query(cache, map, false, "closing the other corner invalidates the path");
+    check(cache.getShortestPath(map).empty(), "diagonal past two closed corners is not taken"); // only way out
+}
+
+
+/* === main function ========================== */
+int main() {
+    checkStraightPath();
+    checkDiagonalPath("8,cut-unless-both,int,octile", false);
+    checkDiagonalPath("8,no-cut,int,octile", true);
+    if (failures) fprintf(stderr, "%d path cache check(s) failed\n", failures);
+    else printf("path cache checks passed\n");
+    return failures ? 1 : 0;
+}
@@ -3,6 +3,7 @@
  */
 
 #include "pathfinder.hpp"
+#include "searchKernel.hpp"
 
 
 /* === pathfinder algorithm implementations ========================== */
@@ -14,111 +15,103 @@ std::vector<Pixel> getShortestPath(Map & map) {
 }
 
 std::vector<Pixel> getShortestPath(Map & map, Pixel & origin, Pixel & target) {
-    // setting the start node and explored nodes
-    NODE currentNode = std::make_pair(origin, std::vector<Pixel>{origin});
-    std::vector<Pixel> explored;
-    // priority queue: used to store neighbours, and retrieve them based on priority
-    std::priority_queue<PRIORITY_PAIR> priorityQueue;
-    priorityQueue.push(std::make_pair(0, currentNode));
-
-    // starting the search loop
-    while (!(currentNode.first == target) || priorityQueue.empty()) {
-        extractPriorityPair(priorityQueue, currentNode);
-        explored.push_back(currentNode.first);
-
-        // searching through neighbours
-        std::vector<Pixel> neighbours = getNeighbours(map, currentNode.first);
-        for (auto & neighbour : neighbours) {
-            // if the pixel has not been explored yet, it is added to queue for exploration
-            if (!std::count(explored.begin(), explored.end(), neighbour)) {
-                std::vector<Pixel> neighbour_path = currentNode.second;
-                neighbour_path.push_back(neighbour);
-
-                // priority queue is updated
-                int newCost = getPathHeuristic(currentNode.second, neighbour) +
-                              getSebastianHeuristic(neighbour, target);
-                priorityQueue.push(std::make_pair(newCost, std::make_pair(neighbour, neighbour_path)));
-            }
-        }
-    }
+    return getShortestPath(map, origin, target, SearchConfig());
+}
 
-    // returning the result
-    if (!(currentNode.first == target)) return std::vector<Pixel>{};
-    return currentNode.second;
+/* kernel dispatch: each configuration option narrows down the kernel's search policy */
+template <class Connectivity, class CornerRule, class Cost>
+static std::vector<Pixel> dispatchHeuristic(Map & map, sf::Vector2u origin, sf::Vector2u target,
+                                            const SearchConfig & config) {
+    switch (config.heuristic) {
+        case SearchConfig::MANHATTAN:
+            return searchKernel<SearchPolicy<Connectivity, CornerRule, Cost, ManhattanHeuristic>>(map, origin, target);
+        case SearchConfig::EUCLIDEAN:
+            return searchKernel<SearchPolicy<Connectivity, CornerRule, Cost, EuclideanHeuristic>>(map, origin, target);
+        case SearchConfig::DIJKSTRA:
+            return searchKernel<SearchPolicy<Connectivity, CornerRule, Cost, DijkstraHeuristic>>(map, origin, target);
+        default:
+            return searchKernel<SearchPolicy<Connectivity, CornerRule, Cost, OctileHeuristic>>(map, origin, target);
+    }
 }
 
-void extractPriorityPair(std::priority_queue<PRIORITY_PAIR> & priorityQueue, NODE & currentNode) {
-    // current node is reassigned to the best node in priority queue
-    PRIORITY_PAIR priorityPair = priorityQueue.top(); priorityQueue.pop();
-    currentNode = priorityPair.second;
+template <class Connectivity, class CornerRule>
+static std::vector<Pixel> dispatchCost(Map & map, sf::Vector2u origin, sf::Vector2u target,
+                                       const SearchConfig & config) {
+    if (config.costType == SearchConfig::FLOAT_COST)
+        return dispatchHeuristic<Connectivity, CornerRule, FloatCost>(map, origin, target, config);
+    return dispatchHeuristic<Connectivity, CornerRule, IntCost>(map, origin, target, config);
 }
 
-int getSebastianHeuristic(Pixel & p1, Pixel & p2) {
-    /** idea from Sebastian Lague's pathfinder heuristic
-     * @see https://youtu.be/nhiFx28e7JY
-     * heuristic returns a negative value;
-     * since priority queue will prioritize the largest (hence closest to zero)
-     */
-    sf::Vector2u distance = Pixel::getPosDist(p1, p2);
-    int minDist = static_cast<int>(std::min(distance.x, distance.y));
-    int remainingDist = static_cast<int>(std::max(distance.x, distance.y) - minDist);
-    return -(minDist * DIAGONAL_DIST + remainingDist * MANHATTAN_DIST);
+std::vector<Pixel> getShortestPath(Map & map, Pixel & origin, Pixel & target, const SearchConfig & config) {
+    // corner rule does not apply to orthogonal moves, hence a single rule for 4-connectivity
+    if (config.connectivity == SearchConfig::FOUR_CONNECTED)
+        return dispatchCost<FourConnected, CornerCutting>(map, origin.getPos(), target.getPos(), config);
+    switch (config.cornerRule) {
+        case SearchConfig::CORNER_CUTTING:
+            return dispatchCost<EightConnected, CornerCutting>(map, origin.getPos(), target.getPos(), config);
+        case SearchConfig::NO_CORNER_CUTTING:
+            return dispatchCost<EightConnected, NoCornerCutting>(map, origin.getPos(), target.getPos(), config);
+        default:
+            return dispatchCost<EightConnected, CornerCutUnlessBothBlocked>(map, origin.getPos(), target.getPos(), config);
+    }
 }
 
-int getPathHeuristic(std::vector<Pixel> & pixelPath, Pixel & p2) {
-    // returns heuristic value of a path going through pixelPath followed with p2
-    int heuristicVal = 0;
-    for (unsigned int i = 0; i < pixelPath.size() - 1; i++) {
-        heuristicVal += getSebastianHeuristic(pixelPath[i], pixelPath[i + 1]);
-    } heuristicVal += getSebastianHeuristic(pixelPath[pixelPath.size() - 1], p2);
-    return heuristicVal;
+bool SearchConfig::parse(const std::string & text, SearchConfig & parsedConfig) {
+    // comma separated: connectivity, corner rule, cost type, heuristic
+    std::vector<std::string> options;
+    size_t start = 0, end;
+    do {
+        end = text.find(',', start);
+        options.push_back(text.substr(start, end == std::string::npos ? std::string::npos : end - start));
+        start = end + 1;
+    } while (end != std::string::npos);
+    if (options.size() != 4) return false;
+    SearchConfig config; // only assigned if all options are valid
+
+    if (options[0] == "4") config.connectivity = FOUR_CONNECTED;
+    else if (options[0] == "8") config.connectivity = EIGHT_CONNECTED;
+    else return false;
+
+    if (options[1] == "cut") config.cornerRule = CORNER_CUTTING;
+    else if (options[1] == "cut-unless-both") config.cornerRule = CORNER_CUT_UNLESS_BOTH_BLOCKED;
+    else if (options[1] == "no-cut") config.cornerRule = NO_CORNER_CUTTING;
+    else return false;
+
+    if (options[2] == "int") config.costType = INT_COST;
+    else if (options[2] == "float") config.costType = FLOAT_COST;
+    else return false;
+
+    if (options[3] == "octile") config.heuristic = OCTILE;
+    else if (options[3] == "manhattan") config.heuristic = MANHATTAN;
+    else if (options[3] == "euclidean") config.heuristic = EUCLIDEAN;
+    else if (options[3] == "dijkstra") config.heuristic = DIJKSTRA;
+    else return false;
+    if (!config.isAdmissible()) return false;
+    parsedConfig = config;
+    return true;
 }
 
+bool SearchConfig::isAdmissible() const {
+    return !(connectivity == EIGHT_CONNECTED && heuristic == MANHATTAN);
+}
 
-/* === pathfinder algorithm helper function implementations ========================== */
-std::vector<Pixel> getNeighbours(Map & map, Pixel & pixel) {
-    // neighbouring path is: neighbouring pixels that are traversable
-    std::vector<Pixel> neighbourList;
-    for (auto & mapPixelRow : map.getPixels()) {
-        for (auto & mapPixel : mapPixelRow) {
-            if (areNeighbours(pixel, mapPixel) && mapPixel.isTraversable(map.getSize())
-                && !areDiagonallyBlocked(map, pixel, mapPixel))
-                neighbourList.push_back(mapPixel);
-        }
-    } return neighbourList;
+std::string SearchConfig::toString() const {
+    static const char * cornerRules[] = {"cut", "cut-unless-both", "no-cut"};
+    static const char * costTypes[] = {"int", "float"};
+    static const char * heuristics[] = {"octile", "manhattan", "euclidean", "dijkstra"};
+    return std::to_string(connectivity) + "," + cornerRules[cornerRule] + "," + costTypes[costType] + ","
+           + heuristics[heuristic];
 }
 
-bool areNeighbours(Pixel & p1, Pixel & p2) {
-    // two pixels are neighbours if:
-    // 1) they have a distance of zero or one 2) they are not the same
-    sf::Vector2u distance = Pixel::getPosDist(p1, p2);
-    return !(p1 == p2) && distance.x <= 1 && distance.y <= 1;
+bool operator==(const SearchConfig & config1, const SearchConfig & config2) {
+    return config1.connectivity == config2.connectivity && config1.cornerRule == config2.cornerRule &&
+           config1.costType == config2.costType && config1.heuristic == config2.heuristic;
 }
 
+
+/* === pathfinder algorithm helper function implementations ========================== */
 bool areDiagonal(Pixel & p1, Pixel & p2) {
     // two pixels are diagonal if they are neighbours and their x and y distances sum to 2
     sf::Vector2u distance = Pixel::getPosDist(p1, p2);
     return distance.x + distance.y == 2;
 }
-
-bool areDiagonallyBlocked(Map & map, Pixel & p1, Pixel & p2) {
-    // diagonally blocked means only direct open path between two pixels is diagonal
-    if (!areDiagonal(p1, p2)) return false;
-    int blockCount = 0;
-    for (auto & mapPixelRow : map.getPixels()) {
-        for (auto & mapPixel : mapPixelRow) {
-            if ((areNeighbours(p1, mapPixel) && areNeighbours(p2, mapPixel))
-                && (mapPixel.getType() == Pixel::CLOSED)) {
-                blockCount++;
-            }
-        }
-    } return blockCount == 2;
-}
-
-
-void printPath(std::vector<Pixel> & pixels) {
-    for (auto & pixel : pixels) {
-        printf("[%d][%d] -> ", pixel.getPos().x, pixel.getPos().y);
-    }
-    printf("|\n");
-}
@@ -8,32 +8,38 @@
 #define MANHATTAN_DIST 10 // manhattan (orthogonal) distance is 10x
 #define DIAGONAL_DIST 14 // diagonal (edge) distance is 14x
 
-#include <cmath>
-#include <queue>
+#include <string>
 #include <iostream>
 #include "map.hpp"
 #include "pixel.hpp"
 
 
 /* === pathfinder structure definition ========================== */
-typedef std::pair<Pixel, std::vector<Pixel>> NODE;
-typedef std::pair<int, NODE> PRIORITY_PAIR;
+struct SearchConfig { // selects the search kernel (see searchKernel.hpp)
+    enum Connectivity { FOUR_CONNECTED=4, EIGHT_CONNECTED=8 };
+    enum CornerRule { CORNER_CUTTING, CORNER_CUT_UNLESS_BOTH_BLOCKED, NO_CORNER_CUTTING }; // 8-connectivity only
+    enum CostType { INT_COST, FLOAT_COST };
+    enum Heuristic { OCTILE, MANHATTAN, EUCLIDEAN, DIJKSTRA }; // MANHATTAN overestimates diagonal moves
+
+    Connectivity connectivity = EIGHT_CONNECTED;
+    CornerRule cornerRule = CORNER_CUT_UNLESS_BOTH_BLOCKED;
+    CostType costType = INT_COST;
+    Heuristic heuristic = OCTILE;
+
+    static bool parse (const std::string&, SearchConfig&); // e.g. "8,cut-unless-both,int,octile" (admissible only)
+    bool isAdmissible () const; // whether the search finds shortest paths (heuristic never overestimates)
+    std::string toString () const; // in the format of parse
+    friend bool operator==(const SearchConfig&, const SearchConfig&);
+};
 
 
 /* === pathfinder algorithm primary function prototypes ========================== */
 std::vector<Pixel> getShortestPath (Map&);
 std::vector<Pixel> getShortestPath (Map&, Pixel&, Pixel&);
-void extractPriorityPair (std::priority_queue<PRIORITY_PAIR>&, NODE&); // extracts and assigns from priority pair
-int getSebastianHeuristic (Pixel&, Pixel&); // returns the heuristic value using Sebastian's method
-int getPathHeuristic (std::vector<Pixel>&, Pixel&); // returns heuristic value of a path
+std::vector<Pixel> getShortestPath (Map&, Pixel&, Pixel&, const SearchConfig&); // dispatches to the configured kernel
 
 
 /* === pathfinder algorithm helper function prototypes ========================== */
-std::vector<Pixel> getNeighbours (Map &map, Pixel &pixel); // returns list of traversable neighbours of given pixel
-bool areNeighbours (Pixel&, Pixel&);
 bool areDiagonal (Pixel&, Pixel&);
-bool areDiagonallyBlocked (Map &, Pixel&, Pixel&);
-
-void printPath (std::vector<Pixel>&);
 
 #endif
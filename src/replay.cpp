@@ -0,0 +1,49 @@
+/**
+ * headless Pathfinder: replays a recorded session without rendering.
+ * usage: PathfinderReplay <session log> [<output log> | -] [<search config>]
+ * search config: <4|8>,<cut|cut-unless-both|no-cut>,<int|float>,<octile|manhattan|euclidean|dijkstra>
+ */
+
+#include <chrono>
+#include "simulation.hpp"
+
+/* === main function ========================== */
+int main(int argc, char * argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <session log> [<output log> | -] [<search config>]\n", argv[0]);
+        return 1;
+    }
+    EventLog log;
+    if (!log.load(argv[1])) return 1;
+
+    // the recorded search config can be overridden (to replay the session with another movement model)
+    if (argc > 3) {
+        SearchConfig config;
+        if (!SearchConfig::parse(argv[3], config)) {
+            fprintf(stderr, "invalid search config %s\n", argv[3]);
+            return 1;
+        }
+        printf("search config: %s (overrides recorded %s)\n", config.toString().c_str(),
+               log.getSearchConfig().toString().c_str());
+        log.setSearchConfig(config);
+    } else printf("search config: %s\n", log.getSearchConfig().toString().c_str());
+
+    // replaying the session (optionally recording it again)
+    Simulation simulation;
+    EventLog replayLog;
+    bool recording = argc > 2 && std::string(argv[2]) != "-";
+    if (recording) simulation.setRecorder(&replayLog);
+    auto start = std::chrono::steady_clock::now();
+    simulation.replay(log);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    // replay summary
+    const std::vector<SimEvent> & events = log.getEvents();
+    printf("events: %zu (session of %u ms)\n", events.size(), events.empty() ? 0 : events.back().time);
+    printf("replayed in: %.3f ms\n", elapsed.count());
+    printf("path cache: %lu hits, %lu misses\n",
+           simulation.getPathCache().getHits(), simulation.getPathCache().getMisses());
+    if (!events.empty()) simulation.getMap().printMap();
+    if (recording && !replayLog.save(argv[2])) return 1;
+    return 0;
+}
@@ -0,0 +1,160 @@
+/**
+ * contains the compile-time specialized A* search kernel.
+ * a kernel is instantiated per search policy: connectivity, corner rule, cost model and heuristic.
+ * policies are resolved at compile time, so the inner loop has no configuration branches or indirect calls.
+ */
+
+#ifndef PATHFINDER_SEARCH_KERNEL_HPP
+#define PATHFINDER_SEARCH_KERNEL_HPP
+
+#include <cmath>
+#include <queue>
+#include <limits>
+#include <functional>
+#include <algorithm>
+#include "map.hpp"
+#include "pathfinder.hpp"
+
+
+/* === neighbour offsets (orthogonal: UP, RIGHT, DOWN, LEFT, followed by diagonals) ========================== */
+constexpr int NEIGHBOUR_DX[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+constexpr int NEIGHBOUR_DY[8] = {-1, 0, 1, 0, -1, 1, 1, -1};
+
+
+/* === connectivity policies ========================== */
+struct FourConnected { static constexpr int NEIGHBOURS = 4; }; // orthogonal moves only
+struct EightConnected { static constexpr int NEIGHBOURS = 8; }; // orthogonal and diagonal moves
+
+
+/* === corner rule policies (given whether the two pixels a diagonal move passes are blocked) ========================== */
+struct CornerCutting { // diagonal moves are always allowed
+    static bool allows (bool, bool) { return true; }
+};
+struct CornerCutUnlessBothBlocked { // diagonal moves are blocked only by two blocked pixels (default)
+    static bool allows (bool block1, bool block2) { return !(block1 & block2); }
+};
+struct NoCornerCutting { // diagonal moves need both passed pixels open
+    static bool allows (bool block1, bool block2) { return !(block1 | block2); }
+};
+
+
+/* === cost model policies ========================== */
+struct IntCost {
+    typedef int Type;
+    static constexpr Type orthogonal () { return MANHATTAN_DIST; }
+    static constexpr Type diagonal () { return DIAGONAL_DIST; }
+};
+struct FloatCost {
+    typedef float Type;
+    static constexpr Type orthogonal () { return 1.0f; }
+    static constexpr Type diagonal () { return 1.41421356f; }
+};
+
+
+/* === heuristic policies (given the x and y distances to the target) ========================== */
+template <class Cost>
+struct OctileHeuristic {
+    /** idea from Sebastian Lague's pathfinder heuristic
+     * @see https://youtu.be/nhiFx28e7JY
+     */
+    static typename Cost::Type estimate (int dx, int dy) {
+        int minDist = std::min(dx, dy);
+        return minDist * Cost::diagonal() + (std::max(dx, dy) - minDist) * Cost::orthogonal();
+    }
+};
+template <class Cost>
+struct ManhattanHeuristic {
+    static typename Cost::Type estimate (int dx, int dy) { return (dx + dy) * Cost::orthogonal(); }
+};
+template <class Cost>
+struct EuclideanHeuristic {
+    static typename Cost::Type estimate (int dx, int dy) {
+        return static_cast<typename Cost::Type>(std::sqrt(static_cast<float>(dx * dx + dy * dy)) * Cost::orthogonal());
+    }
+};
+template <class Cost>
+struct DijkstraHeuristic { // no estimate: plain Dijkstra search
+    static typename Cost::Type estimate (int, int) { return 0; }
+};
+
+
+/* === search policy definition ========================== */
+template <class ConnectivityPolicy, class CornerRulePolicy, class CostPolicy, template <class> class HeuristicPolicy>
+struct SearchPolicy {
+    typedef ConnectivityPolicy Connectivity;
+    typedef CornerRulePolicy CornerRule;
+    typedef CostPolicy Cost;
+    typedef HeuristicPolicy<CostPolicy> Heuristic;
+};
+
+
+/* === search kernel ========================== */
+template <class Policy>
+std::vector<Pixel> searchKernel (Map & map, sf::Vector2u origin, sf::Vector2u target) {
+    typedef typename Policy::Cost::Type CostType;
+    typedef std::pair<CostType, int> QUEUE_PAIR; // estimated path cost, pixel index
+    std::vector<std::vector<Pixel>> & pixels = map.getPixels();
+    const int width = static_cast<int>(map.getSize().x), height = static_cast<int>(map.getSize().y);
+
+    // blocked pixels, surrounded with a blocked border (so that neighbours need no bounds checks)
+    const int stride = height + 2;
+    std::vector<unsigned char> blocked(static_cast<size_t>((width + 2) * stride), 1);
+    for (int x = 0; x < width; x++) {
+        for (int y = 0; y < height; y++) {
+            blocked[(x + 1) * stride + y + 1] = pixels[x][y].getType() == Pixel::CLOSED;
+        }
+    }
+    int offsets[8];
+    for (int i = 0; i < 8; i++) offsets[i] = NEIGHBOUR_DX[i] * stride + NEIGHBOUR_DY[i];
+
+    // search state (per padded pixel index)
+    std::vector<CostType> pathCost(blocked.size(), std::numeric_limits<CostType>::max());
+    std::vector<int> parent(blocked.size(), -1);
+    std::vector<unsigned char> explored(blocked.size(), 0);
+    std::priority_queue<QUEUE_PAIR, std::vector<QUEUE_PAIR>, std::greater<QUEUE_PAIR>> priorityQueue;
+
+    const int targetX = static_cast<int>(target.x), targetY = static_cast<int>(target.y);
+    const int start = (static_cast<int>(origin.x) + 1) * stride + static_cast<int>(origin.y) + 1;
+    const int goal = (targetX + 1) * stride + targetY + 1;
+    pathCost[start] = 0;
+    priorityQueue.push(QUEUE_PAIR(Policy::Heuristic::estimate(std::abs(static_cast<int>(origin.x) - targetX),
+                                                              std::abs(static_cast<int>(origin.y) - targetY)), start));
+
+    // starting the search loop
+    while (!priorityQueue.empty()) {
+        int current = priorityQueue.top().second; priorityQueue.pop();
+        if (explored[current]) continue; // outdated queue entry
+        explored[current] = 1;
+        if (current == goal) break;
+        const int x = current / stride - 1, y = current % stride - 1;
+
+        // relaxes a neighbour with the given move cost
+        auto relax = [&](int i, CostType moveCost) {
+            int next = current + offsets[i];
+            CostType newCost = pathCost[current] + moveCost;
+            if (blocked[next] || explored[next] || !(newCost < pathCost[next])) return;
+            pathCost[next] = newCost;
+            parent[next] = current;
+            priorityQueue.push(QUEUE_PAIR(newCost + Policy::Heuristic::estimate(std::abs(x + NEIGHBOUR_DX[i] - targetX),
+                                                                               std::abs(y + NEIGHBOUR_DY[i] - targetY)), next));
+        };
+        for (int i = 0; i < 4; i++) relax(i, Policy::Cost::orthogonal());
+        for (int i = 4; i < Policy::Connectivity::NEIGHBOURS; i++) { // no iterations for 4-connectivity
+            if (Policy::CornerRule::allows(blocked[current + NEIGHBOUR_DX[i] * stride],
+                                           blocked[current + NEIGHBOUR_DY[i]]))
+                relax(i, Policy::Cost::diagonal());
+        }
+    }
+
+    // returning the result (from origin to target)
+    std::vector<Pixel> path;
+    if (!explored[goal]) return path;
+    for (int current = goal; current != -1; current = parent[current]) {
+        path.push_back(pixels[current / stride - 1][current % stride - 1]);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+
+#endif
@@ -0,0 +1,129 @@
+/**
+ * search kernel checks: every admissible configuration finds paths as short as
+ * the dijkstra kernel with the same movement model, and corner rules hold.
+ */
+
+#include <cmath>
+#include "pathfinder.hpp"
+
+static int failures = 0;
+static void check(bool condition, const std::string & description) {
+    if (!condition) {
+        fprintf(stderr, "FAILED: %s\n", description.c_str());
+        failures++;
+    }
+}
+
+static Map makeMap(const std::vector<std::string> & rows) {
+    // rows of '.' (OPEN) and '#' (CLOSED), pixel types are stored column by column
+    sf::Vector2u size{static_cast<unsigned int>(rows[0].size()), static_cast<unsigned int>(rows.size())};
+    std::vector<Pixel::Type> types;
+    for (unsigned int x = 0; x < size.x; x++) {
+        for (unsigned int y = 0; y < size.y; y++) types.push_back(rows[y][x] == '#' ? Pixel::CLOSED : Pixel::OPEN);
+    } return Map(size, types);
+}
+
+static bool isClosed(Map & map, unsigned int x, unsigned int y) {
+    return map.getPixels()[x][y].getType() == Pixel::CLOSED;
+}
+
+static bool isValidPath(Map & map, std::vector<Pixel> & path, const SearchConfig & config) {
+    // every move is to an open neighbour allowed by the connectivity and corner rule
+    for (unsigned int i = 1; i < path.size(); i++) {
+        sf::Vector2u from = path[i - 1].getPos(), to = path[i].getPos();
+        sf::Vector2u distance = Pixel::getPosDist(path[i - 1], path[i]);
+        if (distance.x > 1 || distance.y > 1 || distance.x + distance.y == 0 || isClosed(map, to.x, to.y)) return false;
+        if (distance.x + distance.y < 2) continue;
+        if (config.connectivity == SearchConfig::FOUR_CONNECTED) return false;
+        int blocked = isClosed(map, from.x, to.y) + isClosed(map, to.x, from.y);
+        if (config.cornerRule == SearchConfig::CORNER_CUT_UNLESS_BOTH_BLOCKED && blocked == 2) return false;
+        if (config.cornerRule == SearchConfig::NO_CORNER_CUTTING && blocked > 0) return false;
+    } return true;
+}
+
+static double getPathCost(std::vector<Pixel> & path, const SearchConfig & config) {
+    double orthogonal = config.costType == SearchConfig::INT_COST ? MANHATTAN_DIST : 1.0;
+    double diagonal = config.costType == SearchConfig::INT_COST ? DIAGONAL_DIST : 1.41421356;
+    double cost = 0;
+    for (unsigned int i = 1; i < path.size(); i++) cost += areDiagonal(path[i - 1], path[i]) ? diagonal : orthogonal;
+    return cost;
+}
+
+
+/* === search kernel checks ========================== */
+static void checkShortestPaths() {
+    Map map = makeMap({"..........",
+                       ".##..#....",
+                       "..#..#.##.",
+                       "..#....#..",
+                       ".###.#.#..",
+                       ".....#....",
+                       ".#.#.##.#.",
+                       "...#....#."});
+    const char * connectivities[] = {"4", "8"};
+    const char * cornerRules[] = {"cut", "cut-unless-both", "no-cut"};
+    const char * costTypes[] = {"int", "float"};
+    const char * heuristics[] = {"octile", "manhattan", "euclidean"};
+
+    std::vector<Pixel *> openPixels = map.getOpenPixels();
+    for (auto connectivity : connectivities) for (auto cornerRule : cornerRules) for (auto costType : costTypes) {
+        std::string model = std::string(connectivity) + "," + cornerRule + "," + costType + ",";
+        SearchConfig dijkstra;
+        check(SearchConfig::parse(model + "dijkstra", dijkstra), "dijkstra config " + model + " is parsed");
+        for (auto heuristic : heuristics) {
+            SearchConfig config;
+            if (!SearchConfig::parse(model + heuristic, config)) {
+                check(std::string(connectivity) == "8" && std::string(heuristic) == "manhattan",
+                      "only 8-connected manhattan is rejected, not " + model + heuristic);
+                continue;
+            }
+            // paths between every pair of open pixels
+            for (unsigned int i = 0; i < openPixels.size(); i++) {
+                for (unsigned int j = 0; j < openPixels.size(); j += 3) {
+                    std::vector<Pixel> path = getShortestPath(map, *openPixels[i], *openPixels[j], config);
+                    std::vector<Pixel> expected = getShortestPath(map, *openPixels[i], *openPixels[j], dijkstra);
+                    std::string description = model + heuristic + " path";
+                    check(path.empty() == expected.empty(), description + " exists as with dijkstra");
+                    if (path.empty() || expected.empty()) continue;
+                    check(path.front().getPos() == openPixels[i]->getPos() && path.back().getPos() == openPixels[j]->getPos(),
+                          description + " connects origin and target");
+                    check(isValidPath(map, path, config), description + " has valid moves");
+                    check(std::abs(getPathCost(path, config) - getPathCost(expected, config)) < 1e-4,
+                          description + " is as short as with dijkstra");
+                }
+            }
+        }
+    }
+}
+
+static void checkCornerRules() {
+    // diagonal move from (0, 0) to (1, 1) past one or two closed corners
+    SearchConfig cut, cutUnlessBoth, noCut;
+    SearchConfig::parse("8,cut,int,octile", cut);
+    SearchConfig::parse("8,cut-unless-both,int,octile", cutUnlessBoth);
+    SearchConfig::parse("8,no-cut,int,octile", noCut);
+
+    Map oneCorner = makeMap({".#",
+                             ".."});
+    Pixel & origin1 = oneCorner.getPixels()[0][0], & target1 = oneCorner.getPixels()[1][1];
+    check(getShortestPath(oneCorner, origin1, target1, cut).size() == 2, "cut passes one closed corner");
+    check(getShortestPath(oneCorner, origin1, target1, cutUnlessBoth).size() == 2, "cut-unless-both passes one closed corner");
+    check(getShortestPath(oneCorner, origin1, target1, noCut).size() == 3, "no-cut goes around one closed corner");
+
+    Map twoCorners = makeMap({".#",
+                              "#."});
+    Pixel & origin2 = twoCorners.getPixels()[0][0], & target2 = twoCorners.getPixels()[1][1];
+    check(getShortestPath(twoCorners, origin2, target2, cut).size() == 2, "cut passes two closed corners");
+    check(getShortestPath(twoCorners, origin2, target2, cutUnlessBoth).empty(), "cut-unless-both stops at two closed corners");
+    check(getShortestPath(twoCorners, origin2, target2, noCut).empty(), "no-cut stops at two closed corners");
+}
+
+
+/* === main function ========================== */
+int main() {
+    checkShortestPaths();
+    checkCornerRules();
+    if (failures) fprintf(stderr, "%d search kernel check(s) failed\n", failures);
+    else printf("search kernel checks passed\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * implementation of simulation.hpp header file
+ */
+
+#include "simulation.hpp"
+
+
+/* === pathfinder simulation class implementation ========================== */
+Simulation::Simulation(): isPaused(false), recorder(nullptr) {}
+Simulation::Simulation(const Map & map): map(map), isPaused(false), recorder(nullptr) {}
+Simulation::Simulation(const Map & map, sf::Vector2u trackerPos, sf::Vector2u runnerPos): Simulation(map) {
+    this->map.setPlayers(trackerPos, runnerPos);
+}
+
+
+/* === pathfinder simulation operation functions ========================== */
+void Simulation::apply(const SimEvent & event) {
+    // maps are only loaded through loadMap (a NEW_MAP event refers to a map of another log)
+    if (event.type == SimEvent::NEW_MAP) {
+        fprintf(stderr, "NEW_MAP events can not be applied, use loadMap or replay instead\n");
+        return;
+    }
+    if (recorder) recorder->addEvent(event);
+    switch (event.type) {
+        case SimEvent::RUNNER_MOVE: map.updateRunnerPosition(event.direction); detectShortestPath(); break;
+        case SimEvent::TILE_TOGGLE: map.updatePixel(event.pos.x, event.pos.y); detectShortestPath(); break;
+        case SimEvent::TRACKER_TICK: if (!isPaused && !shortestPath.empty()) updateTrackerPos(); break;
+        case SimEvent::FIND_PATH: detectShortestPath(); break;
+        case SimEvent::PAUSE: isPaused = !isPaused; break;
+        case SimEvent::NEW_MAP: break;
+    }
+}
+
+void Simulation::run(const std::vector<SimEvent> & events) {
+    for (auto & event : events) apply(event);
+}
+
+void Simulation::replay(const EventLog & log) {
+    setSearchConfig(log.getSearchConfig());
+    for (auto & event : log.getEvents()) {
+        if (event.type == SimEvent::NEW_MAP) loadMap(log.getMap(event.mapIndex), event.time);
+        else apply(event);
+    }
+}
+
+void Simulation::loadMap(const Map & newMap, unsigned int time) {
+    map = newMap;
+    shortestPath.clear(); // path belongs to the previous map
+    pathCache.clear();
+    if (recorder) recorder->addEvent(SimEvent::newMap(time, recorder->addMap(map)));
+}
+
+void Simulation::detectShortestPath() {
+    shortestPath = pathCache.getShortestPath(map);
+    // removing the first and last from tracker (so that tracker and runner are not shown as path)
+    if (shortestPath.size() < 2) shortestPath.clear();
+    else { shortestPath.pop_back(); shortestPath.erase(shortestPath.begin()); }
+    // display the shortestPath (clears the previous path if none has been found)
+    map.displayPath(shortestPath);
+}
+
+void Simulation::updateTrackerPos() {
+    sf::Vector2u trackerPos = Pixel::getTracker(this->map.getPixels()).getPos();
+    sf::Vector2u pathPos = shortestPath.front().getPos();
+    sf::Vector2i directionI = sf::Vector2i {static_cast<int>(pathPos.x - trackerPos.x),
+                                            static_cast<int>(pathPos.y - trackerPos.y)};
+    shortestPath.erase(shortestPath.begin());
+    this->map.displayPath(shortestPath);
+    this->map.updateTrackerPosition(directionI);
+}
+
+
+/* === pathfinder simulation getters and setters ========================== */
+Map &Simulation::getMap() {
+    return map;
+}
+std::vector<Pixel> &Simulation::getShortestPath() {
+    return shortestPath;
+}
+PathCache &Simulation::getPathCache() {
+    return pathCache;
+}
+bool Simulation::getIsPaused() const {
+    return isPaused;
+}
+const SearchConfig &Simulation::getSearchConfig() const {
+    return pathCache.getSearchConfig();
+}
+
+void Simulation::setRecorder(EventLog * log) {
+    recorder = log;
+    if (!recorder) return;
+    recorder->setSearchConfig(pathCache.getSearchConfig());
+    if (!map.getPixels().empty()) recorder->addEvent(SimEvent::newMap(0, recorder->addMap(map)));
+}
+void Simulation::setSearchConfig(const SearchConfig & config) {
+    // a log stores a single search configuration (for the whole session)
+    if (recorder && !recorder->getEvents().empty() && !(config == pathCache.getSearchConfig())) {
+        fprintf(stderr, "search config can not change once events are recorded\n");
+        return;
+    }
+    pathCache.setSearchConfig(config);
+    if (recorder) recorder->setSearchConfig(config);
+}
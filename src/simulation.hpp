@@ -0,0 +1,49 @@
+/**
+ * represents the Pathfinder simulation, independent of the app window.
+ * simulation runs a map (with its tracker and runner) through a stream of events.
+ */
+
+#ifndef PATHFINDER_SIMULATION_HPP
+#define PATHFINDER_SIMULATION_HPP
+
+#include "map.hpp"
+#include "pathCache.hpp"
+#include "eventLog.hpp"
+
+
+/* === pathfinder simulation class definition ========================== */
+class Simulation {
+    Map map; // simulated map (also holding the tracker and runner)
+    std::vector<Pixel> shortestPath; // last updated path between tracker and runner
+    PathCache pathCache; // paths found on the current map
+    bool isPaused; // whether the tracker should be paused
+    EventLog * recorder; // log recording the applied events (if any)
+
+public:
+    /* === constructors and destructor === */
+    Simulation ();
+    explicit Simulation (const Map&);
+    explicit Simulation (const Map&, sf::Vector2u, sf::Vector2u); // map with tracker and runner positions
+
+    /* === simulation operation functions === */
+    void apply (const SimEvent&); // applies a single event (other than NEW_MAP)
+    void run (const std::vector<SimEvent>&); // applies the events in order, as fast as possible (maps are skipped)
+    void replay (const EventLog&); // reproduces a recorded session
+    void loadMap (const Map&, unsigned int); // loads a new map at given time
+    void detectShortestPath ();
+    void updateTrackerPos ();
+
+    /* === getters and setters === */
+    Map & getMap ();
+    std::vector<Pixel> & getShortestPath ();
+    PathCache & getPathCache ();
+    bool getIsPaused () const;
+
+    const SearchConfig & getSearchConfig () const;
+
+    void setRecorder (EventLog *); // starts recording (from the current map) into the log, nullptr stops
+    void setSearchConfig (const SearchConfig&); // movement model (can not change once events are recorded)
+};
+
+
+#endif